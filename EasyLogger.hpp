@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <cstdint>
 #include <chrono>
 #include <ctime>
 #include <fstream>
@@ -11,8 +12,31 @@
 #include <sstream>
 #include <memory>
 #include <unordered_map>
+#include <map>
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <thread>
+#include <condition_variable>
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_register)
+#include <linux/io_uring.h>
+// IORING_OP_WRITE and opcode probing arrived in the Linux 5.6 headers;
+// older headers fall back to pwrite
+#ifdef IO_URING_OP_SUPPORTED
+#define EASYLOGGER_HAS_IO_URING 1
+#endif
+#endif
+#endif
 
 // Optional file/line tracking
 #define EASY_LOG_LOCATION __FILE__, __LINE__
@@ -121,17 +145,513 @@ struct LogConfig {
     bool logToConsole = true;
     bool logToFile = false;
     LogLevel minLevel = BuiltInLevel::DEBUG;
+    bool writeIndex = false;
+    size_t indexBlockSize = 64 * 1024;
+    bool asyncFile = false;
+    size_t asyncBufferSize = 1 << 20;
+};
+
+// Write completion latency of the async file sink
+struct WriteLatencyStats {
+    std::string backend;     // "io_uring", "pwrite" or empty if the sink is not active
+    bool directIO = false;   // file opened with O_DIRECT
+    uint64_t writes = 0;
+    uint64_t bytes = 0;
+    double lastMicros = 0;
+    double maxMicros = 0;
+    double meanMicros = 0;
 };
 
+#ifdef __linux__
+
+#ifdef EASYLOGGER_HAS_IO_URING
+// Minimal io_uring wrapper using the raw syscalls (no liburing dependency)
+class IoUring {
+private:
+    int ringFd = -1;
+    void* sqRing = MAP_FAILED;
+    void* cqRing = MAP_FAILED;
+    size_t sqRingSize = 0;
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesSize = 0;
+    unsigned sqEntries = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqMask = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned* cqMask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+
+    void release() {
+        if (sqes != MAP_FAILED) munmap(sqes, sqesSize);
+        if (cqRing != MAP_FAILED && cqRing != sqRing) munmap(cqRing, cqRingSize);
+        if (sqRing != MAP_FAILED) munmap(sqRing, sqRingSize);
+        if (ringFd >= 0) close(ringFd);
+        ringFd = -1;
+        sqRing = cqRing = MAP_FAILED;
+        sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    }
+
+public:
+    IoUring() = default;
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    ~IoUring() {
+        release();
+    }
+
+    bool init(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        ringFd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (ringFd < 0) return false;
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMmap) {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+
+        sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd, IORING_OFF_SQ_RING);
+        if (sqRing == MAP_FAILED) { release(); return false; }
+
+        cqRing = singleMmap ? sqRing
+                            : mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                   ringFd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED) { release(); return false; }
+
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+                                               MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES));
+        if (sqes == MAP_FAILED) { release(); return false; }
+
+        char* sq = static_cast<char*>(sqRing);
+        char* cq = static_cast<char*>(cqRing);
+        sqEntries = params.sq_entries;
+        sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        // IORING_OP_WRITE needs Linux 5.6, which is also when probing was added
+        if (!supportsWrite()) {
+            release();
+            return false;
+        }
+        return true;
+    }
+
+    bool supportsWrite() {
+        const unsigned opCount = 256;
+        size_t probeSize = sizeof(io_uring_probe) + opCount * sizeof(io_uring_probe_op);
+        io_uring_probe* probe = static_cast<io_uring_probe*>(calloc(1, probeSize));
+        if (!probe) return false;
+
+        bool supported = syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, opCount) >= 0 &&
+                         probe->last_op >= IORING_OP_WRITE &&
+                         (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED);
+        free(probe);
+        return supported;
+    }
+
+    // Write length bytes at offset as chunks of chunkSize, keeping up to one
+    // submission queue worth of chunks in flight. results[i] receives the
+    // bytes written or -errno for chunk i. Returns false if the ring itself
+    // failed, in which case results are incomplete; every write the kernel
+    // accepted has completed by then, so the buffer is free to reuse.
+    bool writeBatch(int fd, const char* data, size_t length, uint64_t offset,
+                    size_t chunkSize, std::vector<long>& results) {
+        size_t chunks = (length + chunkSize - 1) / chunkSize;
+        results.assign(chunks, -ECANCELED);
+
+        for (size_t first = 0; first < chunks; first += sqEntries) {
+            unsigned count = static_cast<unsigned>(std::min<size_t>(sqEntries, chunks - first));
+            unsigned tail = *sqTail;
+            for (unsigned i = 0; i < count; i++) {
+                size_t chunk = first + i;
+                size_t chunkOffset = chunk * chunkSize;
+                unsigned index = (tail + i) & *sqMask;
+                io_uring_sqe* sqe = &sqes[index];
+                std::memset(sqe, 0, sizeof(*sqe));
+                sqe->opcode = IORING_OP_WRITE;
+                sqe->fd = fd;
+                sqe->addr = reinterpret_cast<uint64_t>(data + chunkOffset);
+                sqe->len = static_cast<unsigned>(std::min(chunkSize, length - chunkOffset));
+                sqe->off = offset + chunkOffset;
+                sqe->user_data = chunk;
+                sqArray[index] = index;
+            }
+            __atomic_store_n(sqTail, tail + count, __ATOMIC_RELEASE);
+
+            // Wait for every completion of this round. Each io_uring_enter
+            // submits only the entries the kernel has not consumed yet, so a
+            // retried call never queues a write twice
+            unsigned completed = 0;
+            while (true) {
+                completed += reap(results);
+                if (completed >= count) break;
+
+                unsigned pending = tail + count - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE);
+                long entered = syscall(__NR_io_uring_enter, ringFd, pending, 1, IORING_ENTER_GETEVENTS,
+                                       nullptr, 0);
+                if (entered < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                    // Entries never consumed are dropped with the ring, but
+                    // the consumed ones may still be writing from data
+                    unsigned consumed = __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) - tail;
+                    while (completed < consumed) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        completed += reap(results);
+                    }
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Collect available completions; returns how many were collected
+    unsigned reap(std::vector<long>& results) {
+        unsigned collected = 0;
+        unsigned head = *cqHead;
+        while (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+            const io_uring_cqe& cqe = cqes[head & *cqMask];
+            if (cqe.user_data < results.size()) results[cqe.user_data] = cqe.res;
+            head++;
+            collected++;
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+        return collected;
+    }
+};
+#endif
+
+// File sink that never lets the logging thread wait on disk writes.
+// Lines are appended to one of two page-aligned buffers; a writer thread
+// swaps buffers and writes the full pages of the filled one as a batch of
+// io_uring writes (or pwrite when io_uring is unavailable), using O_DIRECT
+// where the filesystem allows it. With O_DIRECT the partial last page stays
+// in memory until it fills, flush() is called or the sink shuts down; only
+// then is it written zero-padded and the file truncated back to its length.
+class AsyncFileSink {
+private:
+    static constexpr size_t PAGE_SIZE_BYTES = 4096;
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    int fd = -1;
+    bool direct = false;
+    size_t alignment = 1;
+    size_t bufferSize = 0;
+    char* buffers[2] = { nullptr, nullptr };
+    int active = 0;
+
+    size_t used = 0;                 // bytes in the active buffer
+    size_t carried = 0;              // leading bytes of the active buffer already in the file
+    uint64_t bufferOffset = 0;       // file offset of the active buffer's first byte
+    uint64_t writtenUpTo = 0;        // logical file size known to be written
+    bool flushWanted = false;
+    bool stopping = false;
+    bool writeFailed = false;
+
+    std::chrono::milliseconds flushInterval;
+    std::mutex mutex;
+    std::condition_variable writerCv;
+    std::condition_variable producerCv;
+    std::thread writer;
+
+#ifdef EASYLOGGER_HAS_IO_URING
+    std::unique_ptr<IoUring> ring;
+    std::vector<long> chunkResults;
+#endif
+    WriteLatencyStats latency;
+
+    static void reportError(int error) {
+        std::cerr << "[EasyLogger] ERROR: Async file write failed: " << std::strerror(error) << std::endl;
+    }
+
+    static bool pwriteAll(int target, const char* data, size_t length, uint64_t offset) {
+        while (length > 0) {
+            ssize_t result = pwrite(target, data, length, static_cast<off_t>(offset));
+            if (result < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+            if (result <= 0) {
+                reportError(result < 0 ? errno : EIO);
+                return false;
+            }
+            data += result;
+            length -= static_cast<size_t>(result);
+            offset += static_cast<uint64_t>(result);
+        }
+        return true;
+    }
+
+    bool writeAll(const char* data, size_t length, uint64_t offset) {
+#ifdef EASYLOGGER_HAS_IO_URING
+        if (ring && length > 0) {
+            if (ring->writeBatch(fd, data, length, offset, CHUNK_SIZE, chunkResults)) {
+                for (size_t i = 0; i < chunkResults.size(); i++) {
+                    size_t chunkOffset = i * CHUNK_SIZE;
+                    size_t chunkLength = std::min(CHUNK_SIZE, length - chunkOffset);
+                    long result = chunkResults[i];
+                    if (result == static_cast<long>(chunkLength)) continue;
+                    if (result < 0 && result != -EINTR && result != -EAGAIN) {
+                        reportError(static_cast<int>(-result));
+                        return false;
+                    }
+
+                    // Short write: finish the chunk synchronously
+                    size_t done = result > 0 ? static_cast<size_t>(result) : 0;
+                    if (!pwriteAll(fd, data + chunkOffset + done, chunkLength - done,
+                                   offset + chunkOffset + done)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            // The ring itself is broken; use pwrite from now on
+            ring.reset();
+        }
+#endif
+        return pwriteAll(fd, data, length, offset);
+    }
+
+    void writerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            writerCv.wait_for(lock, flushInterval, [&] {
+                return stopping || flushWanted || used == bufferSize;
+            });
+
+            // Periodic writes cover full pages only, so no page is padded
+            // and rewritten on every interval
+            bool writeTail = flushWanted || stopping;
+            size_t fullPages = used / alignment * alignment;
+            bool idle = writeTail ? used == carried : fullPages == 0;
+            if (idle || writeFailed) {
+                flushWanted = false;
+                producerCv.notify_all();
+                if (stopping) break;
+                continue;
+            }
+
+            // Swap buffers; the partial last page moves to the new buffer so
+            // every write starts on an aligned file offset
+            char* out = buffers[active];
+            size_t outLength = used;
+            size_t outCarried = carried;
+            uint64_t outOffset = bufferOffset;
+            size_t tail = outLength - fullPages;
+            size_t written = writeTail ? outLength : fullPages;
+
+            active ^= 1;
+            std::memcpy(buffers[active], out + fullPages, tail);
+            used = tail;
+            carried = writeTail ? tail : 0;
+            bufferOffset = outOffset + fullPages;
+            producerCv.notify_all();
+            lock.unlock();
+
+            size_t writeLength = (written + alignment - 1) / alignment * alignment;
+            std::memset(out + written, 0, writeLength - written);
+
+            auto start = std::chrono::steady_clock::now();
+            bool ok = writeAll(out, writeLength, outOffset);
+            // Drop the zero padding of the last page
+            if (ok && writeLength != written &&
+                ftruncate(fd, static_cast<off_t>(outOffset + written)) != 0) {
+                reportError(errno);
+                ok = false;
+            }
+            double micros = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start).count();
+
+            lock.lock();
+#ifdef EASYLOGGER_HAS_IO_URING
+            if (!ring) latency.backend = "pwrite";
+#endif
+            if (!ok) {
+                writeFailed = true;
+            } else {
+                writtenUpTo = std::max(writtenUpTo, outOffset + written);
+                latency.writes++;
+                latency.bytes += written - outCarried;
+                latency.lastMicros = micros;
+                latency.maxMicros = std::max(latency.maxMicros, micros);
+                latency.meanMicros += (micros - latency.meanMicros) / latency.writes;
+            }
+            producerCv.notify_all();
+        }
+    }
+
+    bool readExistingTail(uint64_t size) {
+        bufferOffset = size / alignment * alignment;
+        size_t tail = static_cast<size_t>(size - bufferOffset);
+        if (tail > 0) {
+            ssize_t result = pread(fd, buffers[active], alignment, static_cast<off_t>(bufferOffset));
+            if (result < static_cast<ssize_t>(tail)) return false;
+        }
+        used = carried = tail;
+        writtenUpTo = size;
+        return true;
+    }
+
+public:
+    AsyncFileSink(const std::string& path,
+                  size_t bufferBytes = 1 << 20,
+                  std::chrono::milliseconds interval = std::chrono::milliseconds(100))
+        : flushInterval(interval) {
+        fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | O_DIRECT, 0644);
+        direct = fd >= 0;
+        if (fd < 0 && errno == EINVAL) {
+            // Filesystem without O_DIRECT support (e.g. tmpfs)
+            fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        }
+        if (fd < 0) return;
+
+        alignment = direct ? PAGE_SIZE_BYTES : 1;
+        bufferSize = std::max<size_t>(bufferBytes, 2 * PAGE_SIZE_BYTES);
+        bufferSize = (bufferSize + PAGE_SIZE_BYTES - 1) / PAGE_SIZE_BYTES * PAGE_SIZE_BYTES;
+        for (auto& buffer : buffers) {
+            void* memory = nullptr;
+            if (posix_memalign(&memory, PAGE_SIZE_BYTES, bufferSize) != 0) {
+                close(fd);
+                fd = -1;
+                return;
+            }
+            buffer = static_cast<char*>(memory);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !readExistingTail(static_cast<uint64_t>(st.st_size))) {
+            close(fd);
+            fd = -1;
+            return;
+        }
+
+        latency.backend = "pwrite";
+        latency.directIO = direct;
+#ifdef EASYLOGGER_HAS_IO_URING
+        ring = std::make_unique<IoUring>();
+        if (ring->init(32)) {
+            latency.backend = "io_uring";
+        } else {
+            ring.reset();
+        }
+#endif
+
+        writer = std::thread(&AsyncFileSink::writerLoop, this);
+    }
+
+    AsyncFileSink(const AsyncFileSink&) = delete;
+    AsyncFileSink& operator=(const AsyncFileSink&) = delete;
+
+    ~AsyncFileSink() {
+        if (writer.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            writerCv.notify_one();
+            writer.join();
+        }
+        if (fd >= 0) close(fd);
+        free(buffers[0]);
+        free(buffers[1]);
+    }
+
+    bool isOpen() const {
+        return fd >= 0;
+    }
+
+    // True once a write has failed; later lines are dropped
+    bool failed() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return writeFailed;
+    }
+
+    // Append data and return the file offset it starts at. Only waits when
+    // both buffers are full, i.e. the disk cannot keep up at all.
+    uint64_t write(const std::string& data) {
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t start = bufferOffset + used;
+        size_t pos = 0;
+        while (pos < data.size() && !writeFailed) {
+            if (used == bufferSize) {
+                writerCv.notify_one();
+                producerCv.wait(lock, [&] { return used < bufferSize || writeFailed; });
+                continue;
+            }
+            size_t chunk = std::min(data.size() - pos, bufferSize - used);
+            std::memcpy(buffers[active] + used, data.data() + pos, chunk);
+            used += chunk;
+            pos += chunk;
+        }
+        if (used == bufferSize) writerCv.notify_one();
+        return start;
+    }
+
+    // Block until everything written so far is in the file and synced to disk
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t target = bufferOffset + used;
+        while (writtenUpTo < target && !writeFailed) {
+            flushWanted = true;
+            writerCv.notify_one();
+            producerCv.wait(lock);
+        }
+        bool ok = !writeFailed;
+        lock.unlock();
+        if (ok) fdatasync(fd);
+    }
+
+    WriteLatencyStats stats() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return latency;
+    }
+};
+
+#endif // __linux__
+
 class Logger {
 private:
     std::string logFile;
     LogConfig config;
     std::mutex logMutex;
     std::unordered_map<int, LogLevel> customLevels;
+
+    // Block of the log file currently being summarized for the sidecar index
+    struct IndexBlock {
+        bool open = false;
+        uint64_t offset = 0;
+        uint64_t end = 0;
+        int64_t firstTime = 0;
+        int64_t lastTime = 0;
+        uint64_t lines = 0;
+        std::map<std::string, uint64_t> levelCounts;
+    };
+    IndexBlock indexBlock;
+    uint64_t indexEnd = 0;           // end offset of the last indexed block
+    bool indexEndKnown = false;
+#ifdef __linux__
+    std::unique_ptr<AsyncFileSink> asyncSink;
+#endif
     
     static std::unique_ptr<Logger> instance;
 
+    static int64_t nowMillis() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
     std::string getTimeStamp(int type) {
         auto now = std::chrono::system_clock::now();
         std::time_t time = std::chrono::system_clock::to_time_t(now);
@@ -204,10 +724,137 @@ private:
         return formatted + (isFile ? "\n" : "");
     }
 
+    // Index file lines: offset end first_ms last_ms lines LEVEL=count...
+    void flushIndexBlock() {
+        if (!indexBlock.open) return;
+        indexBlock.open = false;
+
+        std::string indexFile = logFile + ".idx";
+        std::ofstream file(indexFile, std::ios_base::app);
+        if (!file.is_open()) {
+            std::cerr << "[EasyLogger] ERROR: Could not open index file " << indexFile << std::endl;
+            return;
+        }
+
+        file.seekp(0, std::ios_base::end);
+        if (file.tellp() == std::streampos(0)) {
+            file << "# EasyLogger index v1: offset end first_ms last_ms lines level=count...\n";
+        }
+
+        file << indexBlock.offset << ' ' << indexBlock.end << ' '
+             << indexBlock.firstTime << ' ' << indexBlock.lastTime << ' '
+             << indexBlock.lines;
+        for (const auto& entry : indexBlock.levelCounts) {
+            file << ' ' << entry.first << '=' << entry.second;
+        }
+        file << '\n';
+    }
+
+    // Largest end offset recorded in an existing index file
+    uint64_t readIndexEnd() {
+        std::ifstream file(logFile + ".idx");
+        uint64_t end = 0;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            std::istringstream iss(line);
+            uint64_t blockOffset = 0, blockEnd = 0;
+            if (iss >> blockOffset >> blockEnd) end = std::max(end, blockEnd);
+        }
+        return end;
+    }
+
+    void recordIndexEntry(uint64_t offset, uint64_t end, const std::string& levelName, int64_t time) {
+        if (!indexEndKnown) {
+            indexEnd = readIndexEnd();
+            indexEndKnown = true;
+        }
+
+        // The log file was rotated or truncated, so the existing index
+        // describes data that is gone: start a new one
+        if (offset < indexEnd) {
+            indexBlock.open = false;
+            indexEnd = 0;
+            std::ofstream reset(logFile + ".idx", std::ios_base::trunc);
+        }
+
+        // Start a new block once the current one is full, or if another
+        // writer appended to the file since our last line
+        if (indexBlock.open &&
+            (offset != indexBlock.end || offset >= indexBlock.offset + config.indexBlockSize)) {
+            flushIndexBlock();
+        }
+
+        if (!indexBlock.open) {
+            indexBlock = IndexBlock();
+            indexBlock.open = true;
+            indexBlock.offset = offset;
+            indexBlock.firstTime = time;
+        }
+
+        indexBlock.end = end;
+        indexEnd = end;
+        // Keep a true [min, max] time range even if the clock steps back
+        indexBlock.firstTime = std::min(indexBlock.firstTime, time);
+        indexBlock.lastTime = std::max(indexBlock.lastTime, time);
+        indexBlock.lines++;
+        indexBlock.levelCounts[levelName]++;
+    }
+
+    // (Re)create the async sink for the current log file
+    void resetAsyncSink() {
+#ifdef __linux__
+        asyncSink.reset();
+        if (!config.asyncFile || logFile.empty()) return;
+
+        asyncSink = std::make_unique<AsyncFileSink>(logFile, config.asyncBufferSize);
+        if (!asyncSink->isOpen()) {
+            std::cerr << "[EasyLogger] ERROR: Could not open file " << logFile
+                      << " for async logging, using synchronous writes" << std::endl;
+            asyncSink.reset();
+        }
+#endif
+    }
+
+    bool writeAsync(const std::string& line, const LogLevel& level) {
+#ifdef __linux__
+        if (!asyncSink) return false;
+        if (asyncSink->failed()) {
+            std::cerr << "[EasyLogger] ERROR: Async writes to " << logFile
+                      << " failed, unwritten lines were lost; using synchronous writes" << std::endl;
+            asyncSink.reset();
+            config.asyncFile = false;
+            // The open block may describe lines that never reached the file
+            indexBlock.open = false;
+            indexEnd = 0;
+            return false;
+        }
+
+        uint64_t offset = asyncSink->write(line);
+        if (config.writeIndex) {
+            recordIndexEntry(offset, offset + line.size(), level.name(), nowMillis());
+        }
+        return true;
+#else
+        (void)line;
+        (void)level;
+        return false;
+#endif
+    }
+
 public:
     Logger() = default;
     Logger(const std::string& logfile, const LogConfig& conf) 
-        : logFile(logfile), config(conf) {}
+        : logFile(logfile), config(conf) {
+        resetAsyncSink();
+    }
+
+    ~Logger() {
+        flushIndexBlock();
+#ifdef __linux__
+        asyncSink.reset();
+#endif
+    }
 
     // Get or create singleton instance
     static Logger& getInstance() {
@@ -235,8 +882,12 @@ public:
 
     // Fluent API for configuration
     Logger& setLogFile(const std::string& filename) {
+        std::lock_guard<std::mutex> lock(logMutex);
+        flushIndexBlock();
+        indexEndKnown = false;
         logFile = filename;
         config.logToFile = true;
+        if (config.asyncFile) resetAsyncSink();
         return *this;
     }
 
@@ -272,6 +923,56 @@ public:
         return *this;
     }
 
+    // Write a sidecar index (<logfile>.idx) summarizing every blockSize bytes
+    // of the log file: byte range, time range and per-level line counts.
+    // Used by Tools/LogQuery to skip blocks that cannot match a query.
+    Logger& enableIndex(bool enable = true, size_t blockSize = 64 * 1024) {
+        std::lock_guard<std::mutex> lock(logMutex);
+        if (!enable) flushIndexBlock();
+        indexEndKnown = false;
+        config.writeIndex = enable;
+        config.indexBlockSize = blockSize > 0 ? blockSize : 1;
+        return *this;
+    }
+
+    // Write out the partially filled index block
+    void flushIndex() {
+        std::lock_guard<std::mutex> lock(logMutex);
+        flushIndexBlock();
+    }
+
+    // Write the log file through AsyncFileSink (Linux only): lines go to
+    // aligned in-memory buffers and a writer thread puts them on disk, so
+    // logging threads do not stall on page cache writeback.
+    // Full pages are written within ~100ms; with O_DIRECT the last partial
+    // page is only written by flush() or when the logger shuts down.
+    Logger& enableAsyncFileLogging(bool enable = true, size_t bufferSize = 1 << 20) {
+        std::lock_guard<std::mutex> lock(logMutex);
+        config.asyncFile = enable;
+        config.asyncBufferSize = bufferSize;
+        resetAsyncSink();
+        return *this;
+    }
+
+    // Wait until all logged lines are written to the file (and synced to disk
+    // for the async sink), then write the open index block
+    void flush() {
+        std::lock_guard<std::mutex> lock(logMutex);
+#ifdef __linux__
+        if (asyncSink) asyncSink->flush();
+#endif
+        flushIndexBlock();
+    }
+
+    // Completion latency of async file writes (empty backend if not active)
+    WriteLatencyStats writeLatency() {
+        std::lock_guard<std::mutex> lock(logMutex);
+#ifdef __linux__
+        if (asyncSink) return asyncSink->stats();
+#endif
+        return WriteLatencyStats();
+    }
+
     // Register a custom log level
     LogLevel registerLevel(int value, const std::string& name, const std::string& color = Colors::WHITE) {
         LogLevel level(value, name, color);
@@ -313,9 +1014,19 @@ public:
         }
 
         if (config.logToFile && !logFile.empty()) {
+            std::string line = formatMessage(message, level.name(), "", true);
+            if (writeAsync(line, level)) return;
+
             std::ofstream file(logFile, std::ios_base::app);
             if (file.is_open()) {
-                file << formatMessage(message, level.name(), "", true);
+                if (config.writeIndex) {
+                    file.seekp(0, std::ios_base::end);
+                    uint64_t offset = static_cast<uint64_t>(file.tellp());
+                    file << line;
+                    recordIndexEntry(offset, offset + line.size(), level.name(), nowMillis());
+                } else {
+                    file << line;
+                }
                 file.close();
             } else {
                 std::cerr << "[EasyLogger] ERROR: Could not open file " << logFile << std::endl;
@@ -393,6 +1104,16 @@ public:
     static void setMinLevel(const LogLevel& level) {
         Logger::getInstance().setMinLogLevel(level);
     }
+
+    // Wait until all logged lines are written to the file
+    static void flush() {
+        Logger::getInstance().flush();
+    }
+
+    // Async file sink write latency
+    static WriteLatencyStats writeLatency() {
+        return Logger::getInstance().writeLatency();
+    }
     
     // Log with custom level
     static void custom(const LogLevel& level, const std::string& message) {
@@ -0,0 +1,75 @@
+#include "../EasyLogger.hpp"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Example of the Linux async file sink and the sidecar index used by
+// Tools/LogQuery
+
+int main() {
+#ifdef __linux__
+    //
+    // 1. ASYNC FILE LOGGING WITH AN INDEX
+    //
+
+    // Lines go to aligned in-memory buffers and a writer thread puts them
+    // on disk; every 64 KB of the file is summarized in async.log.idx
+    auto& logger = EasyLogger::Logger::getInstance()
+        .setLogFile("async.log")
+        .setLogFormat("[%d %Th:%Tm:%Ts] [%l] %m")
+        .enableTimeStamps()
+        .enableDateStamp()
+        .enableConsoleLogging(false)
+        .enableIndex(true, 64 * 1024)
+        .enableAsyncFileLogging();
+
+    //
+    // 2. LOG FROM SEVERAL THREADS
+    //
+
+    std::vector<std::thread> threads;
+    for (int id = 0; id < 4; id++) {
+        threads.emplace_back([id]() {
+            for (int i = 0; i < 25000; i++) {
+                if (i % 5000 == 0) {
+                    LOG_ERROR("Thread %d: request %d failed", id, i);
+                } else {
+                    LOG_INFO("Thread %d: handled request %d", id, i);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    //
+    // 3. FLUSH AND REPORT WRITE LATENCY
+    //
+
+    // Wait until every line is written and synced, and the last index block
+    // is written
+    logger.flush();
+
+    EasyLogger::WriteLatencyStats stats = EasyLogger::Log::writeLatency();
+    std::cout << "Backend: " << stats.backend << (stats.directIO ? " (O_DIRECT)" : "") << "\n"
+              << "Writes: " << stats.writes << ", bytes: " << stats.bytes << "\n"
+              << "Latency (us): last " << stats.lastMicros
+              << ", mean " << stats.meanMicros
+              << ", max " << stats.maxMicros << std::endl;
+
+    //
+    // 4. QUERY THE LOG
+    //
+
+    // Build the query tool with Tools/compile_LogQuery.sh, then e.g.:
+    //   ../Tools/LogQuery async.log --level ERROR
+    //   ../Tools/LogQuery async.log --from "2026-01-01 12:00:00" --to "2026-01-01 12:05:00"
+    std::cout << "Try: ../Tools/LogQuery async.log --level ERROR" << std::endl;
+#else
+    std::cout << "The async file sink is only available on Linux" << std::endl;
+#endif
+
+    return 0;
+}
@@ -0,0 +1 @@
+g++ AsyncIndex.cpp -o AsyncIndex -pthread
@@ -0,0 +1,467 @@
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Query tool for log files written by EasyLogger with enableIndex().
+//
+// Uses the sidecar index (<logfile>.idx) to skip blocks that cannot contain
+// the requested level or time range, then scans the remaining blocks of the
+// memory-mapped log file in parallel.
+//
+// Time filtering works at block granularity: every line of a block whose
+// time range overlaps the query is printed. Parts of the file that are not
+// covered by the index (written before indexing was enabled, or after the
+// last index flush) carry no times, so they are skipped when --from/--to is
+// given and printed unfiltered by time with --unindexed scan.
+//
+// A line's level is the first level token in it, found with --level-format
+// (default "[%l]") and the level names listed in the index. This assumes the
+// log format puts %l before %m; formats without %l cannot be filtered by level.
+
+struct IndexEntry {
+    uint64_t offset = 0;
+    uint64_t end = 0;
+    int64_t firstTime = 0;
+    int64_t lastTime = 0;
+    uint64_t lines = 0;
+    std::map<std::string, uint64_t> levelCounts;
+};
+
+struct Range {
+    uint64_t begin;
+    uint64_t end;
+};
+
+struct Query {
+    std::string logFile;
+    std::string indexFile;
+    std::string level;
+    std::string levelFormat = "[%l]";
+    int64_t from = INT64_MIN;
+    int64_t to = INT64_MAX;
+    unsigned threads = 0;
+    int scanUnindexed = -1;   // -1: scan unless a time range is given
+};
+
+static void usage(const char* program) {
+    std::cerr << "Usage: " << program << " <logfile> [options]\n"
+              << "  --level NAME      only lines logged at level NAME (e.g. ERROR)\n"
+              << "  --level-format F  how %l appears in the log format (default: [%l])\n"
+              << "  --from TIME       only blocks logged at or after TIME\n"
+              << "  --to TIME         only blocks logged at or before TIME\n"
+              << "  --threads N       number of scanning threads (default: all cores)\n"
+              << "  --index PATH      index file (default: <logfile>.idx)\n"
+              << "  --unindexed MODE  scan or skip parts of the file missing from the index\n"
+              << "                    (default: skip with --from/--to, scan otherwise)\n"
+              << "TIME is seconds since the epoch or local \"YYYY-MM-DD HH:MM:SS\"\n"
+              << "Unindexed parts have no times; scanning them prints every line\n"
+              << "regardless of --from/--to.\n"
+              << "A line's level is the first level token matching the level format,\n"
+              << "so the log format must contain %l before the message.\n";
+}
+
+static bool parseUnsigned(const std::string& text, uint64_t& value) {
+    if (text.empty() || !std::isdigit(static_cast<unsigned char>(text[0]))) return false;
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = std::strtoull(text.c_str(), &end, 10);
+    if (errno != 0 || *end != '\0') return false;
+    value = parsed;
+    return true;
+}
+
+static bool parseSigned(const std::string& text, int64_t& value) {
+    if (text.empty()) return false;
+    char* end = nullptr;
+    errno = 0;
+    long long parsed = std::strtoll(text.c_str(), &end, 10);
+    if (errno != 0 || end == text.c_str() || *end != '\0') return false;
+    value = parsed;
+    return true;
+}
+
+// Returns milliseconds since the epoch, or -1 if the string is not a time
+static int64_t parseTime(const std::string& text) {
+    if (!text.empty() && std::all_of(text.begin(), text.end(), ::isdigit)) {
+        uint64_t seconds = 0;
+        if (!parseUnsigned(text, seconds) || seconds > static_cast<uint64_t>(INT64_MAX / 1000 - 1)) {
+            return -1;
+        }
+        return static_cast<int64_t>(seconds) * 1000;
+    }
+
+    std::string normalized = text;
+    std::replace(normalized.begin(), normalized.end(), 'T', ' ');
+
+    std::tm tm = {};
+    std::istringstream iss(normalized);
+    iss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
+    if (iss.fail()) return -1;
+
+    tm.tm_isdst = -1;
+    std::time_t time = std::mktime(&tm);
+    if (time == -1) return -1;
+    return static_cast<int64_t>(time) * 1000;
+}
+
+static bool parseArgs(int argc, char** argv, Query& query) {
+    if (argc < 2) return false;
+    query.logFile = argv[1];
+    query.indexFile = query.logFile + ".idx";
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) return false;
+        std::string value = argv[++i];
+
+        if (arg == "--level") {
+            query.level = value;
+        } else if (arg == "--from" || arg == "--to") {
+            int64_t time = parseTime(value);
+            if (time < 0) {
+                std::cerr << "Invalid time: " << value << std::endl;
+                return false;
+            }
+            // Round --to up so the whole second is included
+            if (arg == "--from") query.from = time;
+            else query.to = time + 999;
+        } else if (arg == "--level-format") {
+            if (value.find("%l") == std::string::npos) {
+                std::cerr << "Level format must contain %l" << std::endl;
+                return false;
+            }
+            query.levelFormat = value;
+        } else if (arg == "--threads") {
+            uint64_t threads = 0;
+            if (!parseUnsigned(value, threads) || threads > 1024) {
+                std::cerr << "Invalid thread count: " << value << std::endl;
+                return false;
+            }
+            query.threads = static_cast<unsigned>(threads);
+        } else if (arg == "--index") {
+            query.indexFile = value;
+        } else if (arg == "--unindexed") {
+            if (value != "scan" && value != "skip") {
+                std::cerr << "Invalid --unindexed mode: " << value << std::endl;
+                return false;
+            }
+            query.scanUnindexed = value == "scan";
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+static std::vector<IndexEntry> loadIndex(const std::string& path) {
+    std::vector<IndexEntry> entries;
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[LogQuery] WARNING: No index at " << path << ", scanning whole file" << std::endl;
+        return entries;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        // Skip truncated or corrupt lines
+        std::istringstream iss(line);
+        std::string fields[5];
+        if (!(iss >> fields[0] >> fields[1] >> fields[2] >> fields[3] >> fields[4])) continue;
+
+        IndexEntry entry;
+        if (!parseUnsigned(fields[0], entry.offset) || !parseUnsigned(fields[1], entry.end) ||
+            !parseSigned(fields[2], entry.firstTime) || !parseSigned(fields[3], entry.lastTime) ||
+            !parseUnsigned(fields[4], entry.lines) || entry.end <= entry.offset) {
+            continue;
+        }
+
+        bool valid = true;
+        std::string count;
+        while (valid && iss >> count) {
+            size_t eq = count.rfind('=');
+            uint64_t value = 0;
+            valid = eq != std::string::npos && eq > 0 && parseUnsigned(count.substr(eq + 1), value);
+            if (valid) entry.levelCounts[count.substr(0, eq)] = value;
+        }
+        if (valid) entries.push_back(entry);
+    }
+    return entries;
+}
+
+// Drop entries left over from a rotated or truncated log: anything past the
+// end of the file, or overlapping an entry written after it
+static std::vector<IndexEntry> validEntries(const std::vector<IndexEntry>& entries, uint64_t fileSize) {
+    std::vector<IndexEntry> valid;
+    std::map<uint64_t, uint64_t> kept; // offset -> end of entries written later
+
+    for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+        if (it->end > fileSize) continue;
+
+        auto next = kept.lower_bound(it->offset);
+        if (next != kept.end() && next->first < it->end) continue;
+        if (next != kept.begin() && std::prev(next)->second > it->offset) continue;
+
+        kept[it->offset] = it->end;
+        valid.push_back(*it);
+    }
+
+    std::sort(valid.begin(), valid.end(),
+              [](const IndexEntry& a, const IndexEntry& b) { return a.offset < b.offset; });
+    return valid;
+}
+
+static bool hasTimeRange(const Query& query) {
+    return query.from != INT64_MIN || query.to != INT64_MAX;
+}
+
+static bool scansUnindexed(const Query& query) {
+    return query.scanUnindexed < 0 ? !hasTimeRange(query) : query.scanUnindexed == 1;
+}
+
+static bool blockMatches(const IndexEntry& entry, const Query& query) {
+    if (entry.lastTime < query.from || entry.firstTime > query.to) return false;
+    if (!query.level.empty()) {
+        auto it = entry.levelCounts.find(query.level);
+        if (it == entry.levelCounts.end() || it->second == 0) return false;
+    }
+    return true;
+}
+
+// Byte ranges of the log file that may contain matching lines
+static std::vector<Range> selectRanges(const std::vector<IndexEntry>& entries,
+                                       const Query& query, uint64_t fileSize,
+                                       uint64_t& unindexedBytes) {
+    std::vector<Range> ranges;
+    uint64_t cursor = 0;
+    unindexedBytes = 0;
+    bool scanUnindexed = scansUnindexed(query);
+
+    auto add = [&](uint64_t begin, uint64_t end) {
+        end = std::min(end, fileSize);
+        if (begin >= end) return;
+        if (!ranges.empty() && ranges.back().end == begin) ranges.back().end = end;
+        else ranges.push_back({begin, end});
+    };
+
+    for (const auto& entry : entries) {
+        if (entry.offset >= fileSize) break;
+        if (entry.offset > cursor) {
+            unindexedBytes += std::min(entry.offset, fileSize) - cursor;
+            if (scanUnindexed) add(cursor, entry.offset);
+        }
+        if (entry.end > cursor && blockMatches(entry, query)) {
+            add(std::max(entry.offset, cursor), entry.end);
+        }
+        cursor = std::max(cursor, entry.end);
+    }
+
+    if (cursor < fileSize) {
+        unindexedBytes += fileSize - cursor;
+        if (scanUnindexed) add(cursor, fileSize);
+    }
+    return ranges;
+}
+
+// Split ranges into line-aligned pieces so large ranges spread across threads
+static std::vector<Range> splitRanges(const std::vector<Range>& ranges, const char* data,
+                                      uint64_t pieceSize) {
+    std::vector<Range> pieces;
+    for (const auto& range : ranges) {
+        uint64_t begin = range.begin;
+        while (begin < range.end) {
+            uint64_t end = std::min(begin + pieceSize, range.end);
+            if (end < range.end) {
+                const void* newline = std::memchr(data + end, '\n', range.end - end);
+                end = newline ? static_cast<uint64_t>(static_cast<const char*>(newline) - data) + 1
+                              : range.end;
+            }
+            pieces.push_back({begin, end});
+            begin = end;
+        }
+    }
+    return pieces;
+}
+
+static bool isWordChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// Level tokens as they appear in the log, e.g. "[ERROR]" for format "[%l]"
+struct LevelMatcher {
+    std::vector<std::string> tokens;
+    size_t wanted = 0;
+
+    LevelMatcher(const std::string& format, const std::string& level,
+                 const std::vector<IndexEntry>& entries) {
+        std::vector<std::string> names = { level };
+        for (const auto& entry : entries) {
+            for (const auto& count : entry.levelCounts) {
+                if (std::find(names.begin(), names.end(), count.first) == names.end()) {
+                    names.push_back(count.first);
+                }
+            }
+        }
+
+        size_t pos = format.find("%l");
+        for (const auto& name : names) {
+            tokens.push_back(format.substr(0, pos) + name + format.substr(pos + 2));
+        }
+    }
+
+    // Position of the first whole occurrence of token in line
+    static size_t find(std::string_view line, const std::string& token) {
+        size_t pos = 0;
+        while ((pos = line.find(token, pos)) != std::string_view::npos) {
+            size_t after = pos + token.size();
+            bool wordStart = !isWordChar(token.front()) || pos == 0 || !isWordChar(line[pos - 1]);
+            bool wordEnd = !isWordChar(token.back()) || after == line.size() || !isWordChar(line[after]);
+            if (wordStart && wordEnd) return pos;
+            pos++;
+        }
+        return std::string_view::npos;
+    }
+
+    // True if the first level token in the line is the wanted level
+    bool matches(std::string_view line) const {
+        size_t wantedPos = find(line, tokens[wanted]);
+        if (wantedPos == std::string_view::npos) return false;
+        for (size_t i = 0; i < tokens.size(); i++) {
+            if (i == wanted) continue;
+            size_t pos = find(line.substr(0, wantedPos + tokens[wanted].size()), tokens[i]);
+            if (pos < wantedPos) return false;
+        }
+        return true;
+    }
+};
+
+static void scanPiece(const char* data, const Range& piece, const LevelMatcher* matcher, std::string& out) {
+    std::string_view text(data + piece.begin, piece.end - piece.begin);
+    if (!matcher) {
+        out.assign(text.data(), text.size());
+        return;
+    }
+
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t newline = text.find('\n', start);
+        size_t end = newline == std::string_view::npos ? text.size() : newline + 1;
+        std::string_view line = text.substr(start, end - start);
+        if (matcher->matches(line)) out.append(line.data(), line.size());
+        start = end;
+    }
+}
+
+int main(int argc, char** argv) {
+    Query query;
+    if (!parseArgs(argc, argv, query)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int fd = open(query.logFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "[LogQuery] ERROR: Could not open " << query.logFile << std::endl;
+        return 1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        std::cerr << "[LogQuery] ERROR: Could not stat " << query.logFile << std::endl;
+        close(fd);
+        return 1;
+    }
+    uint64_t fileSize = static_cast<uint64_t>(st.st_size);
+    if (fileSize == 0) {
+        close(fd);
+        return 0;
+    }
+
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "[LogQuery] ERROR: Could not map " << query.logFile << std::endl;
+        return 1;
+    }
+    const char* data = static_cast<const char*>(mapping);
+
+    std::vector<IndexEntry> entries = validEntries(loadIndex(query.indexFile), fileSize);
+    std::unique_ptr<LevelMatcher> matcher;
+    if (!query.level.empty()) {
+        matcher = std::make_unique<LevelMatcher>(query.levelFormat, query.level, entries);
+    }
+    uint64_t unindexedBytes = 0;
+    std::vector<Range> ranges = selectRanges(entries, query, fileSize, unindexedBytes);
+    std::vector<Range> pieces = splitRanges(ranges, data, 4 * 1024 * 1024);
+
+    unsigned threadCount = query.threads ? query.threads : std::thread::hardware_concurrency();
+    threadCount = std::max(1u, std::min<unsigned>(threadCount, static_cast<unsigned>(pieces.size())));
+
+    std::vector<std::string> results(pieces.size());
+    std::atomic<size_t> next(0);
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next.fetch_add(1)) < pieces.size()) {
+            uint64_t alignedBegin = pieces[i].begin - pieces[i].begin % pageSize;
+            madvise(const_cast<char*>(data) + alignedBegin, pieces[i].end - alignedBegin, MADV_WILLNEED);
+            scanPiece(data, pieces[i], matcher.get(), results[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < threadCount; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    uint64_t scannedBytes = 0;
+    for (size_t i = 0; i < pieces.size(); i++) {
+        scannedBytes += pieces[i].end - pieces[i].begin;
+        std::fwrite(results[i].data(), 1, results[i].size(), stdout);
+    }
+    std::fflush(stdout);
+
+    std::cerr << "[LogQuery] Scanned " << scannedBytes << " of " << fileSize << " bytes ("
+              << unindexedBytes << " unindexed) using " << threadCount << " thread(s)" << std::endl;
+
+    if (unindexedBytes > 0 && hasTimeRange(query)) {
+        if (scansUnindexed(query)) {
+            std::cerr << "[LogQuery] WARNING: " << unindexedBytes
+                      << " unindexed bytes were printed without time filtering" << std::endl;
+        } else {
+            std::cerr << "[LogQuery] WARNING: Skipped " << unindexedBytes
+                      << " unindexed bytes; pass --unindexed scan to include them unfiltered by time"
+                      << std::endl;
+        }
+    }
+
+    munmap(mapping, fileSize);
+    return 0;
+}
@@ -0,0 +1 @@
+g++ -O2 -pthread LogQuery.cpp -o LogQuery